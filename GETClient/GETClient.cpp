@@ -4,13 +4,164 @@
 #include <ws2tcpip.h>
 #include <limits>
 #include <windows.h> // For ShellExecute
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
 
 #pragma comment(lib, "Ws2_32.lib")
 
 const int SERVER_PORT = 8080;
 const std::string LOOPBACK_ADDR = "127.0.0.1";
 
-int main() {
+// Send "GET path" to the local server and read the whole response.
+// Returns the body size for a "200 OK" response and -1 otherwise; `responseOut` receives the raw response either way.
+long long FetchLocal(const std::string& httpPath, std::string* responseOut = nullptr) {
+    SOCKET tcpClient = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (tcpClient == INVALID_SOCKET) {
+        std::cerr << "Failed to create socket." << std::endl;
+        return -1;
+    }
+
+    sockaddr_in svrInfo;
+    memset(&svrInfo, 0, sizeof(svrInfo));
+    svrInfo.sin_family = AF_INET;
+    svrInfo.sin_port = htons(SERVER_PORT);
+    inet_pton(AF_INET, LOOPBACK_ADDR.c_str(), &svrInfo.sin_addr);
+
+    if (connect(tcpClient, (sockaddr*)&svrInfo, sizeof(svrInfo)) == SOCKET_ERROR) {
+        std::cerr << "Connect failed." << std::endl;
+        closesocket(tcpClient);
+        return -1;
+    }
+
+    std::string httpRequest = "GET " + httpPath + " HTTP/1.0\r\nHost: " + LOOPBACK_ADDR + "\r\n\r\n";
+    if (send(tcpClient, httpRequest.c_str(), (int)httpRequest.size(), 0) != (int)httpRequest.size()) {
+        std::cerr << "Send failed." << std::endl;
+        closesocket(tcpClient);
+        return -1;
+    }
+
+    // Keep the response header (bounded) to check the status line; the body is only counted
+    std::string responseHead;
+    size_t headerEnd = std::string::npos;
+    long long receivedTotal = 0;
+    char recvBuffer[16384];
+    int recvSize = recv(tcpClient, recvBuffer, sizeof(recvBuffer), 0);
+    while (recvSize > 0) {
+        receivedTotal += recvSize;
+        if (responseOut) responseOut->append(recvBuffer, recvSize);
+        if (headerEnd == std::string::npos && responseHead.size() < 64 * 1024) {
+            responseHead.append(recvBuffer, recvSize);
+            headerEnd = responseHead.find("\r\n\r\n");
+        }
+        recvSize = recv(tcpClient, recvBuffer, sizeof(recvBuffer), 0);
+    }
+    closesocket(tcpClient);
+
+    bool isOk = recvSize == 0 && headerEnd != std::string::npos
+        && responseHead.rfind("HTTP/1.", 0) == 0 && responseHead.compare(8, 5, " 200 ") == 0;
+    return isOk ? receivedTotal - (long long)(headerEnd + 4) : -1;
+}
+
+// Time `count` sequential small GETs and print p50/p99/max in milliseconds
+void MeasureSmallRequests(const std::string& label, const std::string& smallPath, int count) {
+    std::vector<double> latencies;
+    int failures = 0;
+    for (int i = 0; i < count; i++) {
+        auto start = std::chrono::steady_clock::now();
+        if (FetchLocal(smallPath) < 0) {
+            failures++;
+            continue;
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        latencies.push_back(elapsed.count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << label << ": " << latencies.size() << " ok, " << failures << " failed";
+    if (!latencies.empty()) {
+        size_t p50Index = (size_t)(0.50 * (latencies.size() - 1) + 0.5);
+        size_t p99Index = (size_t)(0.99 * (latencies.size() - 1) + 0.5);
+        std::cout << ", p50=" << latencies[p50Index] << "ms p99=" << latencies[p99Index]
+            << "ms max=" << latencies.back() << "ms";
+    }
+    std::cout << std::endl;
+}
+
+// Storm mode: measure small GET latency alone, then again while `bulkCount` clients keep downloading `bulkPath`
+int RunStorm(const std::string& bulkPath, int bulkCount, const std::string& smallPath, int smallCount, long long smallResponseKb) {
+    WSADATA wsaEnv;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaEnv) != 0) {
+        std::cerr << "WSAStartup failed." << std::endl;
+        return 1;
+    }
+
+    // Without a real bulk body there is no storm to measure
+    long long bulkBodySize = FetchLocal(bulkPath);
+    if (bulkBodySize < 0 || bulkBodySize <= smallResponseKb * 1024) {
+        std::cerr << "Bulk path " << bulkPath << " must return 200 with a body larger than " << smallResponseKb
+            << " KB (got " << (bulkBodySize < 0 ? std::string("no 200 response") : std::to_string(bulkBodySize) + " bytes")
+            << ")." << std::endl;
+        WSACleanup();
+        return 1;
+    }
+
+    MeasureSmallRequests("Idle  " + smallPath, smallPath, smallCount);
+
+    std::atomic<bool> stopStorm(false);
+    std::atomic<long long> bulkBytes(0);
+    std::atomic<int> bulkFailures(0);
+    std::vector<std::thread> bulkClients;
+    for (int i = 0; i < bulkCount; i++) {
+        bulkClients.emplace_back([&]() {
+            while (!stopStorm) {
+                long long received = FetchLocal(bulkPath);
+                if (received < 0) {
+                    bulkFailures++;
+                    break;
+                }
+                bulkBytes += received;
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    auto stormStart = std::chrono::steady_clock::now();
+    MeasureSmallRequests("Storm " + smallPath, smallPath, smallCount);
+    stopStorm = true;
+    for (std::thread& client : bulkClients) client.join();
+    std::chrono::duration<double> stormSeconds = std::chrono::steady_clock::now() - stormStart;
+    std::cout << "Bulk: " << bulkCount << " x " << bulkPath << ", " << bulkBytes / (1024 * 1024) << " MB in "
+        << stormSeconds.count() << "s, " << bulkFailures << " clients failed" << std::endl;
+
+    std::string serverStats;
+    if (FetchLocal("/stats", &serverStats) >= 0) {
+        size_t bodyStart = serverStats.find("\r\n\r\n");
+        if (bodyStart != std::string::npos) std::cout << "Server /stats: " << serverStats.substr(bodyStart + 4) << std::endl;
+    }
+
+    WSACleanup();
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    // GETClient --storm <bulkPath> [bulkCount] [smallPath] [smallCount] [smallResponseKb]
+    // smallResponseKb must match the server's --small-response-kb (default 64)
+    if (argc >= 2 && std::string(argv[1]) == "--storm") {
+        int bulkCount = argc >= 4 ? std::atoi(argv[3]) : 8;
+        std::string smallPath = argc >= 5 ? argv[4] : "/main/index.html";
+        int smallCount = argc >= 6 ? std::atoi(argv[5]) : 200;
+        long long smallResponseKb = argc >= 7 ? std::atoll(argv[6]) : 64;
+        if (argc < 3 || bulkCount <= 0 || smallCount <= 0 || smallResponseKb < 0) {
+            std::cerr << "Usage: GETClient --storm <bulkPath> [bulkCount] [smallPath] [smallCount] [smallResponseKb]" << std::endl;
+            return 1;
+        }
+        return RunStorm(argv[2], bulkCount, smallPath, smallCount, smallResponseKb);
+    }
+
     while (true) {
         std::cout << "Please enter server URL (e.g., 127.0.0.1 or another URL, press Enter or type 'quit' to exit): ";
         std::string userInput;
@@ -48,39 +199,9 @@ int main() {
                 continue;
             }
 
-            SOCKET tcpClient = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-            if (tcpClient == INVALID_SOCKET) {
-                std::cerr << "Failed to create socket." << std::endl;
-                WSACleanup();
-                continue;
-            }
-
-            sockaddr_in svrInfo;
-            memset(&svrInfo, 0, sizeof(svrInfo));
-            svrInfo.sin_family = AF_INET;
-            svrInfo.sin_port = htons(SERVER_PORT);
-            inet_pton(AF_INET, LOOPBACK_ADDR.c_str(), &svrInfo.sin_addr);
-
-            if (connect(tcpClient, (sockaddr*)&svrInfo, sizeof(svrInfo)) == SOCKET_ERROR) {
-                std::cerr << "Connect failed." << std::endl;
-                closesocket(tcpClient);
-                WSACleanup();
-                continue;
-            }
-
-            std::string httpRequest = "GET " + httpPath + " HTTP/1.0\r\nHost: " + LOOPBACK_ADDR + "\r\n\r\n";
-            send(tcpClient, httpRequest.c_str(), (int)httpRequest.size(), 0);
-
-            char recvBuffer[4096];
-            int recvSize = recv(tcpClient, recvBuffer, sizeof(recvBuffer) - 1, 0);
+            // Non-200 responses are shown as well
             std::string fullResponse;
-            while (recvSize > 0) {
-                recvBuffer[recvSize] = '\0';
-                fullResponse.append(recvBuffer, recvSize);
-                recvSize = recv(tcpClient, recvBuffer, sizeof(recvBuffer) - 1, 0);
-            }
-
-            closesocket(tcpClient);
+            FetchLocal(httpPath, &fullResponse);
             WSACleanup();
 
             if (fullResponse.empty()) {
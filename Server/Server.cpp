@@ -8,11 +8,271 @@
 #include <algorithm>
 #include <thread>     // Added: for multithreading
 #include <cstring>    // for strlen
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <chrono>
+#include <sstream>
+#include <cstdint>
 
 #pragma comment(lib, "Ws2_32.lib")
 
 const int SERVER_LISTEN_PORT = 8080;
 
+// Egress scheduling settings (can be overridden from the command line, see ParseEgressArgument)
+struct EgressConfig {
+    size_t quantumBytes = 16 * 1024;          // Credit a large body gets per round (times its weight)
+    size_t smallResponseBytes = 64 * 1024;    // Bodies up to this size are always sent with high priority
+    int maxConcurrentSends = 4;               // Number of turns handed out at once. A turn only covers non-blocking
+                                              // send() calls, so a client that stops reading gives it back at once
+    int videoWeight = 1;                      // Deficit round robin weight of video/* bodies
+    int defaultWeight = 4;                    // Deficit round robin weight of all other large bodies
+    int bulkSendBufferBytes = 64 * 1024;      // SO_SNDBUF of large bodies, so the kernel cannot queue more than a few
+                                              // quanta behind the scheduler's back. 0 keeps OS auto-tuning, in which
+                                              // case fairness only holds on the wire when globalBytesPerSec is set
+    uint64_t perConnectionBytesPerSec = 0;    // 0 = unlimited
+    uint64_t globalBytesPerSec = 0;           // 0 = unlimited
+};
+
+EgressConfig g_egressConfig;
+
+// A client that does not read anything for this long is dropped
+const int SEND_STALL_TIMEOUT_SEC = 120;
+
+// Send scheduler shared by all connection threads.
+// A connection must hold a turn while it writes to its (non-blocking) socket. Turns go to the high-priority FIFO
+// queue first (small responses and the first quantum of every response), then to large bodies by deficit round
+// robin: a flow short of credit gets quantumBytes * weight added and goes on sending its staged quanta from the
+// head of the queue until the credit runs out, then moves to the back.
+class EgressScheduler {
+public:
+    struct Flow {
+        int weight = 1;
+        size_t deficit = 0;
+        size_t pendingBytes = 0;
+        size_t allowance = 0;                 // Bytes the flow may send during the current turn
+        bool granted = false;
+        bool grantedFromBulk = false;
+        std::condition_variable turnGranted;
+        std::chrono::steady_clock::time_point nextSendTime;  // Per-connection bandwidth pacing
+    };
+
+    // Blocks until the flow gets a turn; returns how many of its `pendingBytes` it may send now
+    size_t AcquireTurn(Flow& flow, size_t pendingBytes, bool highPriority) {
+        std::unique_lock<std::mutex> lock(schedulerMutex);
+
+        // Per-connection pacing is done before queueing, so a sleeping flow never occupies a turn
+        if (flow.nextSendTime > std::chrono::steady_clock::now()) {
+            lock.unlock();
+            std::this_thread::sleep_until(flow.nextSendTime);
+            lock.lock();
+        }
+
+        flow.pendingBytes = pendingBytes;
+        flow.granted = false;
+        if (highPriority) highPriorityQueue.push_back(&flow);
+        else if (flow.deficit >= pendingBytes) bulkQueue.push_front(&flow);  // Still has credit for this round
+        else bulkQueue.push_back(&flow);
+        DispatchLocked();
+
+        // Under a global cap bulk turns wait for the global clock; while a turn is free the head of the bulk queue
+        // keeps the timer, otherwise the next ReleaseTurn wakes it
+        while (!flow.granted) {
+            bool keepsTimer = g_egressConfig.globalBytesPerSec > 0 && inFlightSends < g_egressConfig.maxConcurrentSends
+                && !bulkQueue.empty() && bulkQueue.front() == &flow;
+            if (keepsTimer) {
+                std::chrono::steady_clock::time_point wakeAt = nextGlobalSendTime;
+                flow.turnGranted.wait_until(lock, wakeAt);
+                DispatchLocked();
+            }
+            else {
+                flow.turnGranted.wait(lock);
+            }
+        }
+        return flow.allowance;
+    }
+
+    // Must be called once after every AcquireTurn with the number of bytes actually written.
+    // `flowDone` means the response is finished or failed, so the flow will not queue again.
+    void ReleaseTurn(Flow& flow, size_t sentBytes, bool flowDone) {
+        std::lock_guard<std::mutex> lock(schedulerMutex);
+        auto now = std::chrono::steady_clock::now();
+        if (g_egressConfig.perConnectionBytesPerSec > 0) {
+            if (flow.nextSendTime < now) flow.nextSendTime = now;
+            flow.nextSendTime += TransmitTime(sentBytes, g_egressConfig.perConnectionBytesPerSec);
+        }
+        if (g_egressConfig.globalBytesPerSec > 0) {
+            // The whole allowance was charged when the turn was granted; give back what was not sent
+            nextGlobalSendTime -= TransmitTime(flow.allowance - sentBytes, g_egressConfig.globalBytesPerSec);
+        }
+        if (flow.grantedFromBulk) {
+            flow.deficit -= std::min<size_t>(sentBytes, flow.deficit);
+            // As in DRR, a flow whose queue ran empty loses its remaining credit
+            if (flowDone) flow.deficit = 0;
+        }
+
+        inFlightSends--;
+        DispatchLocked();
+    }
+
+private:
+    static std::chrono::microseconds TransmitTime(size_t bytes, uint64_t bytesPerSec) {
+        return std::chrono::microseconds((uint64_t)bytes * 1000000ULL / bytesPerSec);
+    }
+
+    // Hand out free turns. High-priority quanta only get charged on the global clock; bulk quanta also wait for it,
+    // which makes the bulk queue the place where large bodies compete, so their weights decide the split.
+    void DispatchLocked() {
+        auto now = std::chrono::steady_clock::now();
+        while (inFlightSends < g_egressConfig.maxConcurrentSends) {
+            Flow* nextFlow = nullptr;
+            if (!highPriorityQueue.empty()) {
+                nextFlow = highPriorityQueue.front();
+                highPriorityQueue.pop_front();
+                nextFlow->grantedFromBulk = false;
+                nextFlow->allowance = std::min<size_t>(nextFlow->pendingBytes, g_egressConfig.quantumBytes);
+            }
+            else if (!bulkQueue.empty()) {
+                if (g_egressConfig.globalBytesPerSec > 0 && nextGlobalSendTime > now) {
+                    bulkQueue.front()->turnGranted.notify_one();  // Let the head start its timed wait
+                    break;
+                }
+                nextFlow = bulkQueue.front();
+                bulkQueue.pop_front();
+                nextFlow->grantedFromBulk = true;
+                if (nextFlow->deficit < nextFlow->pendingBytes) {
+                    nextFlow->deficit += g_egressConfig.quantumBytes * (size_t)nextFlow->weight;
+                }
+                nextFlow->allowance = std::min<size_t>(nextFlow->pendingBytes, nextFlow->deficit);
+            }
+            else {
+                break;
+            }
+            if (g_egressConfig.globalBytesPerSec > 0) {
+                // Idle time may be banked for a burst of one quantum per turn, which also absorbs timer wake-up lag
+                auto burstFloor = now - TransmitTime(g_egressConfig.quantumBytes * (size_t)g_egressConfig.maxConcurrentSends,
+                    g_egressConfig.globalBytesPerSec);
+                if (nextGlobalSendTime < burstFloor) nextGlobalSendTime = burstFloor;
+                nextGlobalSendTime += TransmitTime(nextFlow->allowance, g_egressConfig.globalBytesPerSec);
+            }
+            nextFlow->granted = true;
+            inFlightSends++;
+            nextFlow->turnGranted.notify_one();
+        }
+    }
+
+    std::mutex schedulerMutex;
+    std::deque<Flow*> highPriorityQueue;
+    std::deque<Flow*> bulkQueue;
+    int inFlightSends = 0;
+    std::chrono::steady_clock::time_point nextGlobalSendTime;
+};
+
+EgressScheduler g_egressScheduler;
+
+// Keeps the most recent response latencies (see RecordResponseLatency) for GET /stats
+class LatencyRecorder {
+public:
+    void Record(double milliseconds) {
+        std::lock_guard<std::mutex> lock(recorderMutex);
+        if (samples.size() < MAX_SAMPLES) samples.push_back(milliseconds);
+        else samples[(size_t)(totalCount % MAX_SAMPLES)] = milliseconds;
+        totalCount++;
+    }
+
+    std::string ToJson() {
+        std::vector<double> sorted;
+        uint64_t count;
+        {
+            std::lock_guard<std::mutex> lock(recorderMutex);
+            sorted = samples;
+            count = totalCount;
+        }
+        std::sort(sorted.begin(), sorted.end());
+        std::ostringstream oss;
+        oss << "{\"count\":" << count
+            << ",\"p50_ms\":" << Percentile(sorted, 0.50)
+            << ",\"p99_ms\":" << Percentile(sorted, 0.99)
+            << ",\"max_ms\":" << (sorted.empty() ? 0.0 : sorted.back()) << "}";
+        return oss.str();
+    }
+
+private:
+    static double Percentile(const std::vector<double>& sorted, double fraction) {
+        if (sorted.empty()) return 0.0;
+        size_t index = (size_t)(fraction * (double)(sorted.size() - 1) + 0.5);
+        return sorted[index];
+    }
+
+    static const size_t MAX_SAMPLES = 4096;
+    std::mutex recorderMutex;
+    std::vector<double> samples;
+    uint64_t totalCount = 0;
+};
+
+LatencyRecorder g_smallResponseLatency;
+LatencyRecorder g_largeResponseLatency;
+
+// Parse a plain decimal number within [minValue, maxValue]; signs and trailing characters are rejected
+bool ParseBoundedNumber(const std::string& text, uint64_t minValue, uint64_t maxValue, uint64_t& value) {
+    if (text.empty() || text[0] < '0' || text[0] > '9') return false;
+    size_t parsedChars = 0;
+    try {
+        value = std::stoull(text, &parsedChars);
+    }
+    catch (...) {
+        return false;
+    }
+    return parsedChars == text.size() && value >= minValue && value <= maxValue;
+}
+
+// Parse one "--name=value" command line option into g_egressConfig. Sizes are in KB, rates in KB/s.
+bool ParseEgressArgument(const std::string& argument) {
+    size_t eqIndex = argument.find('=');
+    if (eqIndex == std::string::npos) return false;
+    std::string name = argument.substr(0, eqIndex);
+    std::string text = argument.substr(eqIndex + 1);
+    uint64_t value = 0;
+
+    if (name == "--quantum-kb") {
+        if (!ParseBoundedNumber(text, 1, 1024, value)) return false;
+        g_egressConfig.quantumBytes = (size_t)value * 1024;
+    }
+    else if (name == "--small-response-kb") {
+        if (!ParseBoundedNumber(text, 0, 1024 * 1024, value)) return false;
+        g_egressConfig.smallResponseBytes = (size_t)value * 1024;
+    }
+    else if (name == "--max-concurrent-sends") {
+        if (!ParseBoundedNumber(text, 1, 256, value)) return false;
+        g_egressConfig.maxConcurrentSends = (int)value;
+    }
+    else if (name == "--video-weight") {
+        if (!ParseBoundedNumber(text, 1, 64, value)) return false;
+        g_egressConfig.videoWeight = (int)value;
+    }
+    else if (name == "--default-weight") {
+        if (!ParseBoundedNumber(text, 1, 64, value)) return false;
+        g_egressConfig.defaultWeight = (int)value;
+    }
+    else if (name == "--bulk-sndbuf-kb") {
+        if (!ParseBoundedNumber(text, 0, 16 * 1024, value)) return false;
+        g_egressConfig.bulkSendBufferBytes = (int)value * 1024;
+    }
+    else if (name == "--per-conn-kbps") {
+        if (!ParseBoundedNumber(text, 0, 10ULL * 1024 * 1024, value)) return false;
+        g_egressConfig.perConnectionBytesPerSec = value * 1024;
+    }
+    else if (name == "--global-kbps") {
+        if (!ParseBoundedNumber(text, 0, 10ULL * 1024 * 1024, value)) return false;
+        g_egressConfig.globalBytesPerSec = value * 1024;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
 std::string InferMimeType(const std::string& resourcePath) {
     size_t dotIndex = resourcePath.find_last_of('.');
     if (dotIndex == std::string::npos) return "application/octet-stream";
@@ -73,6 +333,136 @@ std::string ExtractXFilename(const std::string& httpRequest) {
     return extractedName;
 }
 
+// send() may accept fewer bytes than requested, so loop until everything is written
+bool SendAll(SOCKET socketForClient, const char* data, size_t length) {
+    size_t sentTotal = 0;
+    while (sentTotal < length) {
+        int chunk = (int)std::min<size_t>(length - sentTotal, 64 * 1024);
+        int sent = send(socketForClient, data + sentTotal, chunk, 0);
+        if (sent == SOCKET_ERROR) {
+            std::cerr << "[ERROR] send() failed. WSAGetLastError=" << WSAGetLastError() << std::endl;
+            return false;
+        }
+        sentTotal += sent;
+    }
+    return true;
+}
+
+bool SetSocketNonBlocking(SOCKET socketForClient, bool nonBlocking) {
+    u_long mode = nonBlocking ? 1 : 0;
+    return ioctlsocket(socketForClient, FIONBIO, &mode) == 0;
+}
+
+// Wait until the socket accepts more data. Done without holding a turn, so a slow client only delays itself.
+bool WaitUntilWritable(SOCKET socketForClient) {
+    fd_set writeSet;
+    FD_ZERO(&writeSet);
+    FD_SET(socketForClient, &writeSet);
+    timeval stallTimeout;
+    stallTimeout.tv_sec = SEND_STALL_TIMEOUT_SEC;
+    stallTimeout.tv_usec = 0;
+
+    int ready = select((int)socketForClient + 1, nullptr, &writeSet, nullptr, &stallTimeout);
+    if (ready == 0) {
+        std::cerr << "[ERROR] Client stopped reading for " << SEND_STALL_TIMEOUT_SEC << "s, dropping connection." << std::endl;
+        return false;
+    }
+    if (ready == SOCKET_ERROR) {
+        std::cerr << "[ERROR] select() failed. WSAGetLastError=" << WSAGetLastError() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Send header + body through the egress scheduler. The next quantum is read from `body` before a turn is
+// requested, and the socket is non-blocking meanwhile, so a turn only ever covers send() calls: it ends when the
+// staged bytes are out, the allowance is used up or the socket buffer is full.
+bool SendScheduledResponse(SOCKET socketForClient, const std::string& header, std::istream& body, uint64_t bodyLength, int weight) {
+    EgressScheduler::Flow flow;
+    flow.weight = weight;
+    bool isSmallResponse = bodyLength <= g_egressConfig.smallResponseBytes;
+    std::vector<char> stagingBuffer(header.begin(), header.end());
+    size_t stagingOffset = 0;
+    uint64_t bodyRemaining = bodyLength;
+    uint64_t totalSent = 0;
+
+    if (!isSmallResponse && g_egressConfig.bulkSendBufferBytes > 0) {
+        int sendBufferBytes = g_egressConfig.bulkSendBufferBytes;
+        if (setsockopt(socketForClient, SOL_SOCKET, SO_SNDBUF, (const char*)&sendBufferBytes, sizeof(sendBufferBytes)) == SOCKET_ERROR) {
+            std::cerr << "[ERROR] setsockopt(SO_SNDBUF) failed. WSAGetLastError=" << WSAGetLastError() << std::endl;
+        }
+    }
+    if (!SetSocketNonBlocking(socketForClient, true)) {
+        std::cerr << "[ERROR] ioctlsocket(FIONBIO) failed. WSAGetLastError=" << WSAGetLastError() << std::endl;
+        return false;
+    }
+
+    // Append the next quantum of the body to the staging buffer; done without holding a turn
+    auto stageNextQuantum = [&]() {
+        size_t toRead = (size_t)std::min<uint64_t>(bodyRemaining, g_egressConfig.quantumBytes);
+        size_t stagedBefore = stagingBuffer.size();
+        stagingBuffer.resize(stagedBefore + toRead);
+        body.read(stagingBuffer.data() + stagedBefore, (std::streamsize)toRead);
+        if ((size_t)body.gcount() != toRead) {
+            std::cerr << "[ERROR] Short read while sending response body." << std::endl;
+            return false;
+        }
+        bodyRemaining -= toRead;
+        return true;
+    };
+
+    // The first quantum goes out together with the header
+    bool sendOk = stageNextQuantum();
+    while (sendOk && (stagingOffset < stagingBuffer.size() || bodyRemaining > 0)) {
+        if (stagingOffset == stagingBuffer.size()) {
+            stagingBuffer.clear();
+            stagingOffset = 0;
+            if (!stageNextQuantum()) {
+                sendOk = false;
+                break;
+            }
+        }
+
+        if (!WaitUntilWritable(socketForClient)) {
+            sendOk = false;
+            break;
+        }
+
+        size_t stagedBytes = stagingBuffer.size() - stagingOffset;
+        bool isHighPriority = isSmallResponse || totalSent < g_egressConfig.quantumBytes;
+        size_t allowance = g_egressScheduler.AcquireTurn(flow, stagedBytes, isHighPriority);
+
+        size_t sentThisTurn = 0;
+        while (sentThisTurn < allowance) {
+            int toSend = (int)(allowance - sentThisTurn);
+            int sent = send(socketForClient, stagingBuffer.data() + stagingOffset, toSend, 0);
+            if (sent == SOCKET_ERROR) {
+                if (WSAGetLastError() != WSAEWOULDBLOCK) {
+                    std::cerr << "[ERROR] send() failed. WSAGetLastError=" << WSAGetLastError() << std::endl;
+                    sendOk = false;
+                }
+                break;
+            }
+            stagingOffset += sent;
+            sentThisTurn += sent;
+        }
+
+        totalSent += sentThisTurn;
+        bool finished = stagingOffset == stagingBuffer.size() && bodyRemaining == 0;
+        g_egressScheduler.ReleaseTurn(flow, sentThisTurn, finished || !sendOk);
+    }
+
+    SetSocketNonBlocking(socketForClient, false);
+    return sendOk;
+}
+
+// Latency from `responseStart` (GET: request header received, POST: upload body received) to the last byte sent
+void RecordResponseLatency(std::chrono::steady_clock::time_point responseStart, uint64_t bodyLength) {
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - responseStart;
+    if (bodyLength <= g_egressConfig.smallResponseBytes) g_smallResponseLatency.Record(elapsed.count());
+    else g_largeResponseLatency.Record(elapsed.count());
+}
+
 void ProcessConnection(SOCKET socketForClient) {
     // Read header (loop until "\r\n\r\n" is encountered)
     std::string accumulatedRequest;
@@ -117,6 +507,8 @@ void ProcessConnection(SOCKET socketForClient) {
         return;
     }
 
+    auto requestStart = std::chrono::steady_clock::now();
+
     std::cout << "[DEBUG] Received request header:\n" << std::string(accumulatedRequest.c_str(), hdrEndIndex + 4) << std::endl;
 
     // Determine request method
@@ -138,23 +530,51 @@ void ProcessConnection(SOCKET socketForClient) {
 
         std::ifstream ifsFile(reqPath, std::ios::binary);
         if (!ifsFile.is_open()) {
+            // Latency statistics of the egress scheduler (only when no real file is called "stats")
+            if (reqPath == "stats") {
+                std::string statsJson = "{\"small\":" + g_smallResponseLatency.ToJson()
+                    + ",\"large\":" + g_largeResponseLatency.ToJson() + "}";
+                std::string statsHeader =
+                    "HTTP/1.0 200 OK\r\n"
+                    "Content-Type: application/json\r\n"
+                    "Content-Length: " + std::to_string(statsJson.size()) + "\r\n"
+                    "\r\n";
+                SendAll(socketForClient, statsHeader.data(), statsHeader.size());
+                SendAll(socketForClient, statsJson.data(), statsJson.size());
+                closesocket(socketForClient);
+                return;
+            }
+
             std::string notFoundResponse = "HTTP/1.0 404 Not Found\r\nContent-Length:0\r\n\r\n";
             send(socketForClient, notFoundResponse.c_str(), (int)notFoundResponse.size(), 0);
             closesocket(socketForClient);
             return;
         }
-        std::string fileContents((std::istreambuf_iterator<char>(ifsFile)), std::istreambuf_iterator<char>());
-        ifsFile.close();
+        // Stream the file in quanta instead of loading it into memory (large videos)
+        ifsFile.seekg(0, std::ios::end);
+        std::streamoff endOffset = ifsFile.tellg();
+        ifsFile.seekg(0, std::ios::beg);
+        if (endOffset < 0 || !ifsFile) {
+            std::cerr << "[ERROR] Cannot determine size of " << reqPath << std::endl;
+            std::string errResp = "HTTP/1.0 500 Internal Server Error\r\nContent-Length:0\r\n\r\n";
+            send(socketForClient, errResp.c_str(), (int)errResp.size(), 0);
+            closesocket(socketForClient);
+            return;
+        }
+        uint64_t fileSize = (uint64_t)endOffset;
 
         std::string mimeType = InferMimeType(reqPath);
         std::string okHeader =
             "HTTP/1.0 200 OK\r\n"
             "Content-Type: " + mimeType + "\r\n"
-            "Content-Length: " + std::to_string(fileContents.size()) + "\r\n"
+            "Content-Length: " + std::to_string(fileSize) + "\r\n"
             "\r\n";
 
-        send(socketForClient, okHeader.c_str(), (int)okHeader.size(), 0);
-        send(socketForClient, fileContents.c_str(), (int)fileContents.size(), 0);
+        int flowWeight = (mimeType.rfind("video/", 0) == 0) ? g_egressConfig.videoWeight : g_egressConfig.defaultWeight;
+        if (SendScheduledResponse(socketForClient, okHeader, ifsFile, fileSize, flowWeight)) {
+            RecordResponseLatency(requestStart, fileSize);
+        }
+        ifsFile.close();
 
         closesocket(socketForClient);
         return;
@@ -251,6 +671,7 @@ void ProcessConnection(SOCKET socketForClient) {
 
         ofsOut.flush();
         ofsOut.close();
+        auto responseStart = std::chrono::steady_clock::now();
 
         std::cout << "[DEBUG] Received and wrote " << bytesWritten << " / " << contentLen
             << " bytes to " << diskPath << std::endl;
@@ -265,8 +686,10 @@ void ProcessConnection(SOCKET socketForClient) {
             "Content-Length: " + std::to_string(jsonResponse.size()) + "\r\n"
             "\r\n";
 
-        send(socketForClient, responseHeader.c_str(), (int)responseHeader.size(), 0);
-        send(socketForClient, jsonResponse.c_str(), (int)jsonResponse.size(), 0);
+        std::istringstream jsonStream(jsonResponse);
+        if (SendScheduledResponse(socketForClient, responseHeader, jsonStream, jsonResponse.size(), g_egressConfig.defaultWeight)) {
+            RecordResponseLatency(responseStart, jsonResponse.size());
+        }
 
         closesocket(socketForClient);
         std::cout << "[DEBUG] Client connection closed. File saved at " << diskPath << std::endl;
@@ -280,9 +703,25 @@ void ProcessConnection(SOCKET socketForClient) {
     }
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     std::cout << "[DEBUG] Starting server initialization..." << std::endl;
 
+    for (int i = 1; i < argc; i++) {
+        if (!ParseEgressArgument(argv[i])) {
+            std::cerr << "[ERROR] Unknown or invalid option: " << argv[i] << std::endl;
+            std::cerr << "Options: --quantum-kb=1..1024 --small-response-kb=N --max-concurrent-sends=1..256"
+                " --video-weight=1..64 --default-weight=1..64 --bulk-sndbuf-kb=N --per-conn-kbps=N --global-kbps=N (0 = unlimited)" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "[DEBUG] Egress: quantum=" << g_egressConfig.quantumBytes
+        << "B small<=" << g_egressConfig.smallResponseBytes
+        << "B concurrentSends=" << g_egressConfig.maxConcurrentSends
+        << " weights(video/other)=" << g_egressConfig.videoWeight << "/" << g_egressConfig.defaultWeight
+        << " bulkSndBuf=" << g_egressConfig.bulkSendBufferBytes
+        << " perConn=" << g_egressConfig.perConnectionBytesPerSec
+        << "B/s global=" << g_egressConfig.globalBytesPerSec << "B/s" << std::endl;
+
     WSADATA wsaStartupData;
     int wsaInitCode = WSAStartup(MAKEWORD(2, 2), &wsaStartupData);
     if (wsaInitCode != 0) {